@@ -1,4 +1,10 @@
-﻿#include <iostream>
+﻿#ifdef _WIN32
+#define NOMINMAX
+#define WIN32_LEAN_AND_MEAN
+#include <windows.h>
+#endif
+
+#include <iostream>
 #include <vector>
 #include <random>
 #include <iomanip>
@@ -6,6 +12,22 @@
 #include <queue>
 #include <climits>
 #include <string>
+#include <functional>
+#include <utility>
+#include <cmath>
+#include <fstream>
+#include <sstream>
+#include <map>
+#include <thread>
+#include <mutex>
+#include <condition_variable>
+#include <atomic>
+#include <set>
+#include <cerrno>
+#include <cstdlib>
+#include <deque>
+#include <cstring>
+#include <cstdio>
 
 struct ResultSummary {
     double avgWaiting = 0.0;
@@ -24,18 +46,18 @@ struct Process {
     int finishTime;     
     int waitingTime;    
     int turnaroundTime;  
+    int deadline;
+    int period;
 };
 
-std::vector<Process> generateProcesses(int count) {
+std::vector<Process> generateProcesses(int count, std::mt19937& gen) {
     std::vector<Process> processes;
     processes.reserve(count);
 
-    std::random_device rd;
-    std::mt19937 gen(rd());
-
     std::uniform_int_distribution<int> arrivalDist(0, 10); 
     std::uniform_int_distribution<int> burstDist(1, 10);    
     std::uniform_int_distribution<int> prioDist(1, 5);     
+    std::uniform_int_distribution<int> slackDist(0, 15);
 
     for (int i = 0; i < count; ++i) {
         Process p;
@@ -50,6 +72,8 @@ std::vector<Process> generateProcesses(int count) {
         p.finishTime = -1;
         p.waitingTime = 0;
         p.turnaroundTime = 0;
+        p.deadline = p.arrivalTime + p.burstTime + slackDist(gen);
+        p.period = 0;
 
         processes.push_back(p);
     }
@@ -57,6 +81,63 @@ std::vector<Process> generateProcesses(int count) {
     return processes;
 }
 
+std::vector<Process> generateProcesses(int count) {
+    std::random_device rd;
+    std::mt19937 gen(rd());
+    return generateProcesses(count, gen);
+}
+
+std::vector<Process> generatePeriodicTasks(int count, std::mt19937& gen, double targetUtilization = 0.7) {
+    std::vector<Process> tasks;
+    tasks.reserve(count);
+
+    const int periods[] = { 10, 20, 25, 40, 50, 100, 200, 250, 500, 1000, 2000, 5000, 10000 };
+    const int periodCount = static_cast<int>(sizeof(periods) / sizeof(periods[0]));
+    std::uniform_int_distribution<int> periodDist(0, 5);
+    std::uniform_int_distribution<int> prioDist(1, 5);
+    std::uniform_real_distribution<double> unitDist(0.0, 1.0);
+
+    double remainingUtilization = targetUtilization;
+
+    for (int i = 0; i < count; ++i) {
+        double share = remainingUtilization;
+        if (i + 1 < count) {
+            double next = remainingUtilization * std::pow(unitDist(gen), 1.0 / (count - i - 1));
+            share = remainingUtilization - next;
+            remainingUtilization = next;
+        }
+
+        Process p;
+        p.id = i + 1;
+        p.arrivalTime = 0;
+
+        int periodIndex = periodDist(gen);
+        while (periodIndex + 1 < periodCount && share * periods[periodIndex] < 1.0)
+            periodIndex++;
+        p.period = periods[periodIndex];
+        p.burstTime = std::max(1, static_cast<int>(std::lround(share * p.period)));
+        p.priority = prioDist(gen);
+        p.initialPriority = p.priority;
+
+        p.remainingTime = p.burstTime;
+        p.startTime = -1;
+        p.finishTime = -1;
+        p.waitingTime = 0;
+        p.turnaroundTime = 0;
+        p.deadline = p.arrivalTime + p.period;
+
+        tasks.push_back(p);
+    }
+
+    return tasks;
+}
+
+std::vector<Process> generatePeriodicTasks(int count) {
+    std::random_device rd;
+    std::mt19937 gen(rd());
+    return generatePeriodicTasks(count, gen);
+}
+
 void printProcesses(const std::vector<Process>& processes) {
     std::cout << "Generated processes:\n";
     std::cout << std::left
@@ -64,6 +145,8 @@ void printProcesses(const std::vector<Process>& processes) {
         << std::setw(10) << "Arrival"
         << std::setw(10) << "Burst"
         << std::setw(10) << "Prio"
+        << std::setw(10) << "Deadline"
+        << std::setw(10) << "Period"
         << "\n";
 
     for (const auto& p : processes) {
@@ -72,15 +155,100 @@ void printProcesses(const std::vector<Process>& processes) {
             << std::setw(10) << p.arrivalTime
             << std::setw(10) << p.burstTime
             << std::setw(10) << p.priority
+            << std::setw(10) << p.deadline
+            << std::setw(10) << p.period
             << "\n";
     }
     std::cout << "----------------------------------------\n";
 }
 
-ResultSummary simulateFCFS(std::vector<Process> processes) {
+bool parseInt(const std::string& text, int& value) {
+    if (text.empty())
+        return false;
+    char* end = nullptr;
+    errno = 0;
+    long parsed = std::strtol(text.c_str(), &end, 10);
+    if (errno != 0 || *end != '\0' || parsed < INT_MIN || parsed > INT_MAX)
+        return false;
+    value = static_cast<int>(parsed);
+    return true;
+}
+
+bool parseDouble(const std::string& text, double& value) {
+    if (text.empty())
+        return false;
+    char* end = nullptr;
+    errno = 0;
+    double parsed = std::strtod(text.c_str(), &end);
+    if (errno != 0 || *end != '\0' || !std::isfinite(parsed))
+        return false;
+    value = parsed;
+    return true;
+}
+
+bool loadProcessesFromFile(const std::string& path, std::vector<Process>& processes) {
+    std::ifstream in(path);
+    if (!in) {
+        std::cout << "Cannot open workload file: " << path << "\n";
+        return false;
+    }
+
+    processes.clear();
+    std::set<int> ids;
+    std::string line;
+    int lineNo = 0;
+
+    while (std::getline(in, line)) {
+        lineNo++;
+        std::string::size_type hash = line.find('#');
+        if (hash != std::string::npos)
+            line.erase(hash);
+
+        std::istringstream fields(line);
+        std::vector<std::string> tokens;
+        std::string token;
+        while (fields >> token)
+            tokens.push_back(token);
+        if (tokens.empty())
+            continue;
+
+        Process p;
+        p.deadline = -1;
+        p.period = 0;
+        int* targets[] = { &p.id, &p.arrivalTime, &p.burstTime, &p.priority, &p.deadline, &p.period };
+
+        bool valid = tokens.size() >= 4 && tokens.size() <= 6;
+        for (std::size_t k = 0; valid && k < tokens.size(); ++k)
+            valid = parseInt(tokens[k], *targets[k]);
+
+        if (!valid || p.arrivalTime < 0 || p.burstTime <= 0 || p.deadline < -1 || p.period < 0) {
+            std::cout << "Invalid process at " << path << ":" << lineNo
+                << " (expected: id arrival burst priority [deadline [period]])\n";
+            return false;
+        }
+        if (!ids.insert(p.id).second) {
+            std::cout << "Duplicate process id " << p.id << " at " << path << ":" << lineNo << "\n";
+            return false;
+        }
+
+        p.initialPriority = p.priority;
+        p.remainingTime = p.burstTime;
+        p.startTime = -1;
+        p.finishTime = -1;
+        p.waitingTime = 0;
+        p.turnaroundTime = 0;
+
+        processes.push_back(p);
+    }
+
+    return true;
+}
+
+ResultSummary simulateFCFS(std::vector<Process> processes, std::ostream& out = std::cout,
+    std::vector<Process>* finalState = nullptr) {
     int n = static_cast<int>(processes.size());
     if (n == 0) {
-        std::cout << "\n=== FCFS Scheduling ===\nNo processes.\n";
+        out << "\n=== FCFS Scheduling ===\nNo processes.\n";
         return { 0.0, 0.0, "FCFS" };
     }
     std::sort(processes.begin(), processes.end(),
@@ -94,8 +262,8 @@ ResultSummary simulateFCFS(std::vector<Process> processes) {
     double totalWaiting = 0.0;
     double totalTurnaround = 0.0;
 
-    std::cout << "\n=== FCFS Scheduling ===\n";
-    std::cout << std::left
+    out << "\n=== FCFS Scheduling ===\n";
+    out << std::left
         << std::setw(5) << "ID"
         << std::setw(10) << "Arrive"
         << std::setw(10) << "Burst"
@@ -119,7 +287,7 @@ ResultSummary simulateFCFS(std::vector<Process> processes) {
         totalWaiting += p.waitingTime;
         totalTurnaround += p.turnaroundTime;
 
-        std::cout << std::left
+        out << std::left
             << std::setw(5) << p.id
             << std::setw(10) << p.arrivalTime
             << std::setw(10) << p.burstTime
@@ -130,24 +298,28 @@ ResultSummary simulateFCFS(std::vector<Process> processes) {
             << "\n";
     }
 
-    std::cout << "-----------------------------------------------\n";
+    out << "-----------------------------------------------\n";
     double avgW = totalWaiting / n;
     double avgT = totalTurnaround / n;
-    std::cout << "Average waiting time:    " << avgW << "\n";
-    std::cout << "Average turnaround time: " << avgT << "\n\n";
+    out << "Average waiting time:    " << avgW << "\n";
+    out << "Average turnaround time: " << avgT << "\n\n";
+
+    if (finalState)
+        *finalState = processes;
 
     return { avgW, avgT, "FCFS" };
 }
 
-ResultSummary simulateRoundRobin(std::vector<Process> processes, int quantum) {
+ResultSummary simulateRoundRobin(std::vector<Process> processes, int quantum, std::ostream& out = std::cout,
+    std::vector<Process>* finalState = nullptr) {
     int n = static_cast<int>(processes.size());
     if (n == 0) {
-        std::cout << "\n=== Round Robin Scheduling ===\nNo processes.\n";
+        out << "\n=== Round Robin Scheduling ===\nNo processes.\n";
         return { 0.0, 0.0, "Round Robin" };
     }
 
     if (quantum <= 0) {
-        std::cout << "Invalid quantum.\n";
+        out << "Invalid quantum.\n";
         return { 0.0, 0.0, "Round Robin" };
     }
 
@@ -159,8 +331,8 @@ ResultSummary simulateRoundRobin(std::vector<Process> processes, int quantum) {
         p.turnaroundTime = 0;
     }
 
-    std::cout << "\n=== Round Robin Scheduling ===\n";
-    std::cout << "Time quantum = " << quantum << "\n";
+    out << "\n=== Round Robin Scheduling ===\n";
+    out << "Time quantum = " << quantum << "\n";
 
     int currentTime = 0;
     int completed = 0;
@@ -193,7 +365,7 @@ ResultSummary simulateRoundRobin(std::vector<Process> processes, int quantum) {
     double totalWaiting = 0.0;
     double totalTurnaround = 0.0;
 
-    std::cout << "\nExecution log (time slices):\n";
+    out << "\nExecution log (time slices):\n";
 
     while (completed < n) {
         if (readyQueue.empty()) {
@@ -213,7 +385,6 @@ ResultSummary simulateRoundRobin(std::vector<Process> processes, int quantum) {
 
         int idx = readyQueue.front();
         readyQueue.pop();
-        inQueue[idx] = false;
 
         Process& p = processes[idx];
 
@@ -226,7 +397,7 @@ ResultSummary simulateRoundRobin(std::vector<Process> processes, int quantum) {
         currentTime += runTime;
         p.remainingTime -= runTime;
 
-        std::cout << "t=" << startSlice << " .. " << currentTime
+        out << "t=" << startSlice << " .. " << currentTime
             << " | P" << p.id
             << " ran for " << runTime
             << ", remaining = " << p.remainingTime << "\n";
@@ -235,6 +406,7 @@ ResultSummary simulateRoundRobin(std::vector<Process> processes, int quantum) {
 
         if (p.remainingTime == 0) {
             finished[idx] = true;
+            inQueue[idx] = false;
             p.finishTime = currentTime;
             p.turnaroundTime = p.finishTime - p.arrivalTime;
             p.waitingTime = p.turnaroundTime - p.burstTime;
@@ -245,12 +417,11 @@ ResultSummary simulateRoundRobin(std::vector<Process> processes, int quantum) {
         }
         else {
             readyQueue.push(idx);
-            inQueue[idx] = true;
         }
     }
 
-    std::cout << "\nResult table (Round Robin):\n";
-    std::cout << std::left
+    out << "\nResult table (Round Robin):\n";
+    out << std::left
         << std::setw(5) << "ID"
         << std::setw(10) << "Arrive"
         << std::setw(10) << "Burst"
@@ -261,7 +432,7 @@ ResultSummary simulateRoundRobin(std::vector<Process> processes, int quantum) {
         << "\n";
 
     for (const auto& p : processes) {
-        std::cout << std::left
+        out << std::left
             << std::setw(5) << p.id
             << std::setw(10) << p.arrivalTime
             << std::setw(10) << p.burstTime
@@ -272,19 +443,23 @@ ResultSummary simulateRoundRobin(std::vector<Process> processes, int quantum) {
             << "\n";
     }
 
-    std::cout << "-----------------------------------------------\n";
+    out << "-----------------------------------------------\n";
     double avgW = totalWaiting / n;
     double avgT = totalTurnaround / n;
-    std::cout << "Average waiting time:    " << avgW << "\n";
-    std::cout << "Average turnaround time: " << avgT << "\n\n";
+    out << "Average waiting time:    " << avgW << "\n";
+    out << "Average turnaround time: " << avgT << "\n\n";
+
+    if (finalState)
+        *finalState = processes;
 
     return { avgW, avgT, "Round Robin" };
 }
 
-ResultSummary simulatePriority(std::vector<Process> processes) {
+ResultSummary simulatePriority(std::vector<Process> processes, std::ostream& out = std::cout,
+    std::vector<Process>* finalState = nullptr) {
     int n = static_cast<int>(processes.size());
     if (n == 0) {
-        std::cout << "\n=== Priority Scheduling (Non-preemptive) ===\nNo processes.\n";
+        out << "\n=== Priority Scheduling (Non-preemptive) ===\nNo processes.\n";
         return { 0.0, 0.0, "Priority" };
     }
 
@@ -299,7 +474,7 @@ ResultSummary simulatePriority(std::vector<Process> processes) {
 
     }
 
-    std::cout << "\n=== Priority Scheduling (Non-preemptive) ===\n";
+    out << "\n=== Priority Scheduling (Non-preemptive) ===\n";
 
     int currentTime = 0;
     int completed = 0;
@@ -349,8 +524,8 @@ ResultSummary simulatePriority(std::vector<Process> processes) {
         totalTurnaround += p.turnaroundTime;
     }
 
-    std::cout << "\nResult table (Priority Scheduling):\n";
-    std::cout << std::left
+    out << "\nResult table (Priority Scheduling):\n";
+    out << std::left
         << std::setw(5) << "ID" 
         << std::setw(10) << "Arrive" 
         << std::setw(10) << "Burst" 
@@ -362,7 +537,7 @@ ResultSummary simulatePriority(std::vector<Process> processes) {
         << "\n";
 
     for (const auto& p : processes) {
-        std::cout << std::left
+        out << std::left
             << std::setw(5) << p.id
             << std::setw(10) << p.arrivalTime
             << std::setw(10) << p.burstTime
@@ -374,19 +549,23 @@ ResultSummary simulatePriority(std::vector<Process> processes) {
             << "\n";
     }
 
-    std::cout << "-----------------------------------------------\n";
+    out << "-----------------------------------------------\n";
     double avgW = totalWaiting / n;
     double avgT = totalTurnaround / n;
-    std::cout << "Average waiting time:    " << avgW << "\n";
-    std::cout << "Average turnaround time: " << avgT << "\n\n";
+    out << "Average waiting time:    " << avgW << "\n";
+    out << "Average turnaround time: " << avgT << "\n\n";
+
+    if (finalState)
+        *finalState = processes;
 
     return { avgW, avgT, "Priority" };
 }
 
-ResultSummary simulateSJF(std::vector<Process> processes) {
+ResultSummary simulateSJF(std::vector<Process> processes, std::ostream& out = std::cout,
+    std::vector<Process>* finalState = nullptr) {
     int n = static_cast<int>(processes.size());
     if (n == 0) {
-        std::cout << "\n=== Shortest Job First (SJF) ===\nNo processes.\n";
+        out << "\n=== Shortest Job First (SJF) ===\nNo processes.\n";
         return { 0.0, 0.0, "SJF" };
     }
 
@@ -398,7 +577,7 @@ ResultSummary simulateSJF(std::vector<Process> processes) {
         p.turnaroundTime = 0;
     }
 
-    std::cout << "\n=== Shortest Job First (SJF, non-preemptive) ===\n";
+    out << "\n=== Shortest Job First (SJF, non-preemptive) ===\n";
 
     int currentTime = 0;
     int completed = 0;
@@ -464,8 +643,8 @@ ResultSummary simulateSJF(std::vector<Process> processes) {
         totalTurnaround += p.turnaroundTime;
     }
 
-    std::cout << "\nResult table (SJF):\n";
-    std::cout << std::left
+    out << "\nResult table (SJF):\n";
+    out << std::left
         << std::setw(5) << "ID"
         << std::setw(10) << "Arrive"
         << std::setw(10) << "Burst"
@@ -476,7 +655,7 @@ ResultSummary simulateSJF(std::vector<Process> processes) {
         << "\n";
 
     for (const auto& p : processes) {
-        std::cout << std::left
+        out << std::left
             << std::setw(5) << p.id
             << std::setw(10) << p.arrivalTime
             << std::setw(10) << p.burstTime
@@ -487,19 +666,23 @@ ResultSummary simulateSJF(std::vector<Process> processes) {
             << "\n";
     }
 
-    std::cout << "-----------------------------------------------\n";
+    out << "-----------------------------------------------\n";
     double avgW = totalWaiting / n;
     double avgT = totalTurnaround / n;
-    std::cout << "Average waiting time:    " << avgW << "\n";
-    std::cout << "Average turnaround time: " << avgT << "\n\n";
+    out << "Average waiting time:    " << avgW << "\n";
+    out << "Average turnaround time: " << avgT << "\n\n";
+
+    if (finalState)
+        *finalState = processes;
 
     return { avgW, avgT, "SJF" };
 }
 
-ResultSummary simulateDynamicPriority(std::vector<Process> processes) {
+ResultSummary simulateDynamicPriority(std::vector<Process> processes, std::ostream& out = std::cout,
+    std::vector<Process>* finalState = nullptr) {
     int n = static_cast<int>(processes.size());
     if (n == 0) {
-        std::cout << "\n=== Dynamic Priority Scheduling ===\nNo processes.\n";
+        out << "\n=== Dynamic Priority Scheduling ===\nNo processes.\n";
         return { 0.0, 0.0, "Dynamic Priority" };
     }
 
@@ -512,7 +695,7 @@ ResultSummary simulateDynamicPriority(std::vector<Process> processes) {
         p.priority = p.initialPriority;
     }
 
-    std::cout << "\n=== Dynamic Priority Scheduling (Preemptive with Aging) ===\n";
+    out << "\n=== Dynamic Priority Scheduling (Preemptive with Aging) ===\n";
 
     int currentTime = 0;
     int completed = 0;
@@ -532,7 +715,7 @@ ResultSummary simulateDynamicPriority(std::vector<Process> processes) {
     }
     currentTime = earliestArrival;
 
-    std::cout << "\nExecution log (time = 1 unit per step):\n";
+    out << "\nExecution log (time = 1 unit per step):\n";
 
     while (completed < n) {
         int best = -1;
@@ -572,7 +755,7 @@ ResultSummary simulateDynamicPriority(std::vector<Process> processes) {
         p.remainingTime--;
         currentTime++;
 
-        std::cout << "t=" << startT
+        out << "t=" << startT
             << " | running P" << p.id
             << " (prio=" << p.priority << "), remaining="
             << p.remainingTime << "\n";
@@ -600,8 +783,8 @@ ResultSummary simulateDynamicPriority(std::vector<Process> processes) {
         }
     }
 
-    std::cout << "\nResult table (Dynamic Priority):\n";
-    std::cout << std::left
+    out << "\nResult table (Dynamic Priority):\n";
+    out << std::left
         << std::setw(5) << "ID"
         << std::setw(10) << "Arrive"
         << std::setw(10) << "Burst"
@@ -614,7 +797,7 @@ ResultSummary simulateDynamicPriority(std::vector<Process> processes) {
         << "\n";
 
     for (const auto& p : processes) {
-        std::cout << std::left
+        out << std::left
             << std::setw(5) << p.id
             << std::setw(10) << p.arrivalTime
             << std::setw(10) << p.burstTime
@@ -627,102 +810,1849 @@ ResultSummary simulateDynamicPriority(std::vector<Process> processes) {
             << "\n";
     }
 
-    std::cout << "-----------------------------------------------\n";
+    out << "-----------------------------------------------\n";
     double avgW = totalWaiting / n;
     double avgT = totalTurnaround / n;
-    std::cout << "Average waiting time:    " << avgW << "\n";
-    std::cout << "Average turnaround time: " << avgT << "\n\n";
+    out << "Average waiting time:    " << avgW << "\n";
+    out << "Average turnaround time: " << avgT << "\n\n";
+
+    if (finalState)
+        *finalState = processes;
 
     return { avgW, avgT, "Dynamic Priority" };
 }
 
-void runAllAlgorithms(const std::vector<Process>& base) {
-    std::cout << "\n=== RUNNING ALL ALGORITHMS ON SAME PROCESS SET ===\n";
+enum class HeapPolicy {
+    FCFS,
+    Priority,
+    SJF
+};
+
+std::vector<Process> simulateNonPreemptiveHeap(std::vector<Process> processes, HeapPolicy policy) {
+    int n = static_cast<int>(processes.size());
 
-    std::vector<ResultSummary> results;
+    for (auto& p : processes) {
+        p.remainingTime = p.burstTime;
+        p.startTime = -1;
+        p.finishTime = -1;
+        p.waitingTime = 0;
+        p.turnaroundTime = 0;
+        p.priority = p.initialPriority;
+    }
+
+    std::vector<int> byArrival(n);
+    for (int i = 0; i < n; ++i)
+        byArrival[i] = i;
+    std::stable_sort(byArrival.begin(), byArrival.end(),
+        [&](int a, int b) { return processes[a].arrivalTime < processes[b].arrivalTime; });
+
+    typedef std::pair<std::pair<int, int>, int> HeapKey;
+    auto keyOf = [&](int i) -> HeapKey {
+        const Process& p = processes[i];
+        if (policy == HeapPolicy::FCFS)
+            return { { p.arrivalTime, p.id }, i };
+        if (policy == HeapPolicy::Priority)
+            return { { p.priority, i }, i };
+        return { { p.burstTime, p.id }, i };
+    };
+
+    std::priority_queue<HeapKey, std::vector<HeapKey>, std::greater<HeapKey>> ready;
+    int next = 0;
+    int currentTime = 0;
 
-    results.push_back(simulateFCFS(base));
+    while (next < n || !ready.empty()) {
+        if (ready.empty() && currentTime < processes[byArrival[next]].arrivalTime)
+            currentTime = processes[byArrival[next]].arrivalTime;
+        while (next < n && processes[byArrival[next]].arrivalTime <= currentTime)
+            ready.push(keyOf(byArrival[next++]));
 
-    int quantum = 2;
-    std::cout << "\n[INFO] Using quantum = " << quantum << " for Round Robin in summary mode.\n";
-    results.push_back(simulateRoundRobin(base, quantum));
-    results.push_back(simulatePriority(base));
-    results.push_back(simulateDynamicPriority(base));
-    results.push_back(simulateSJF(base));
+        Process& p = processes[ready.top().second];
+        ready.pop();
 
-    std::cout << "\n=== SUMMARY TABLE (AVERAGE TIMES) ===\n";
-    std::cout << std::left
-        << std::setw(20) << "Algorithm"
-        << std::setw(20) << "Avg Waiting"
-        << std::setw(20) << "Avg Turnaround"
+        p.startTime = currentTime;
+        p.finishTime = currentTime + p.burstTime;
+        p.waitingTime = p.startTime - p.arrivalTime;
+        p.turnaroundTime = p.finishTime - p.arrivalTime;
+        currentTime = p.finishTime;
+    }
+
+    return processes;
+}
+
+ResultSummary simulateHeapScheduler(const std::vector<Process>& base, HeapPolicy policy, std::ostream& out = std::cout,
+    std::vector<Process>* finalState = nullptr) {
+    const std::string name = policy == HeapPolicy::FCFS ? "FCFS"
+        : policy == HeapPolicy::Priority ? "Priority" : "SJF";
+    const std::string title = policy == HeapPolicy::FCFS ? "FCFS Scheduling"
+        : policy == HeapPolicy::Priority ? "Priority Scheduling (Non-preemptive)" : "Shortest Job First (SJF)";
+
+    int n = static_cast<int>(base.size());
+    if (n == 0) {
+        out << "\n=== " << title << " ===\nNo processes.\n";
+        return { 0.0, 0.0, name };
+    }
+
+    std::vector<Process> processes = simulateNonPreemptiveHeap(base, policy);
+
+    if (policy == HeapPolicy::FCFS) {
+        std::sort(processes.begin(), processes.end(),
+            [](const Process& a, const Process& b) {
+                if (a.arrivalTime == b.arrivalTime)
+                    return a.id < b.id;
+                return a.arrivalTime < b.arrivalTime;
+            });
+        out << "\n=== FCFS Scheduling ===\n";
+    }
+    else if (policy == HeapPolicy::Priority) {
+        out << "\n=== Priority Scheduling (Non-preemptive) ===\n";
+        out << "\nResult table (Priority Scheduling):\n";
+    }
+    else {
+        out << "\n=== Shortest Job First (SJF, non-preemptive) ===\n";
+        out << "\nResult table (SJF):\n";
+    }
+
+    const bool showPriority = policy == HeapPolicy::Priority;
+    out << std::left
+        << std::setw(5) << "ID"
+        << std::setw(10) << "Arrive"
+        << std::setw(10) << "Burst";
+    if (showPriority)
+        out << std::setw(10) << "Prio";
+    out << std::setw(10) << "Start"
+        << std::setw(10) << "Finish"
+        << std::setw(12) << "Waiting"
+        << std::setw(12) << "Turnaround"
         << "\n";
 
-    for (const auto& r : results) {
-        std::cout << std::left
-            << std::setw(20) << r.name
-            << std::setw(20) << r.avgWaiting
-            << std::setw(20) << r.avgTurnaround
+    double totalWaiting = 0.0;
+    double totalTurnaround = 0.0;
+
+    for (const auto& p : processes) {
+        totalWaiting += p.waitingTime;
+        totalTurnaround += p.turnaroundTime;
+
+        out << std::left
+            << std::setw(5) << p.id
+            << std::setw(10) << p.arrivalTime
+            << std::setw(10) << p.burstTime;
+        if (showPriority)
+            out << std::setw(10) << p.initialPriority;
+        out << std::setw(10) << p.startTime
+            << std::setw(10) << p.finishTime
+            << std::setw(12) << p.waitingTime
+            << std::setw(12) << p.turnaroundTime
             << "\n";
     }
 
-    std::cout << "---------------------------------------------\n";
+    out << "-----------------------------------------------\n";
+    double avgW = totalWaiting / n;
+    double avgT = totalTurnaround / n;
+    out << "Average waiting time:    " << avgW << "\n";
+    out << "Average turnaround time: " << avgT << "\n\n";
+
+    if (finalState)
+        *finalState = processes;
+
+    return { avgW, avgT, name };
 }
 
-int main() {
-    int n;
-    std::cout << "Enter number of processes: ";
-    std::cin >> n;
+struct DeadlineJob {
+    int key;
+    int deadline;
+    int release;
+    int remaining;
+    int task;
+};
 
-    if (n <= 0) {
-        std::cout << "Invalid number.\n";
-        return 0;
+struct DeadlineJobOrder {
+    bool operator()(const DeadlineJob& a, const DeadlineJob& b) const {
+        if (a.key != b.key)
+            return a.key > b.key;
+        if (a.release != b.release)
+            return a.release > b.release;
+        return a.task > b.task;
     }
+};
 
-    auto processes = generateProcesses(n);
-    printProcesses(processes);
+int periodicHorizon(const std::vector<Process>& processes) {
+    const long long cap = 1000000;
+    long long hyper = 0;
+    int latestArrival = 0;
 
-    while (true) {
-        std::cout << "\nChoose algorithm:\n";
-        std::cout << "1 - FCFS (First-Come-First-Served)\n";
-        std::cout << "2 - Round Robin\n";
-        std::cout << "3 - Priority Scheduling (non-preemptive)\n";
-        std::cout << "4 - Dynamic Priority (preemptive, with aging)\n";
-        std::cout << "5 - Shortest Job First (SJF)\n";
-        std::cout << "6 - Run ALL algorithms and show summary\n";
-        std::cout << "0 - Exit\n";
-        std::cout << "Your choice: ";
+    for (const auto& p : processes) {
+        if (p.period <= 0)
+            continue;
+        latestArrival = std::max(latestArrival, p.arrivalTime);
+        if (hyper == 0) {
+            hyper = p.period;
+            continue;
+        }
+        long long a = hyper, b = p.period;
+        while (b != 0) {
+            long long t = a % b;
+            a = b;
+            b = t;
+        }
+        hyper = std::min(cap, hyper / a * p.period);
+    }
 
-        int choice;
-        std::cin >> choice;
+    return static_cast<int>(std::min(cap, latestArrival + hyper));
+}
 
-        if (!std::cin) {
-            std::cout << "Input error. Exiting.\n";
-            break;
+ResultSummary simulateDeadlineScheduler(std::vector<Process> processes, int horizon, bool rateMonotonic, std::ostream& out = std::cout) {
+    const std::string name = rateMonotonic ? "Rate Monotonic" : "EDF";
+    int n = static_cast<int>(processes.size());
+    if (n == 0) {
+        out << "\n=== " << name << " Scheduling ===\nNo processes.\n";
+        return { 0.0, 0.0, name };
+    }
+
+    for (auto& p : processes) {
+        p.remainingTime = p.burstTime;
+        p.startTime = -1;
+        p.finishTime = -1;
+        p.waitingTime = 0;
+        p.turnaroundTime = 0;
+    }
+
+    if (rateMonotonic)
+        out << "\n=== Rate Monotonic Scheduling (Preemptive, static priority by period) ===\n";
+    else
+        out << "\n=== Earliest Deadline First (EDF, preemptive) ===\n";
+    out << "Horizon for periodic releases = " << horizon << "\n";
+
+    auto keyOf = [&](int i, int deadline) {
+        const Process& p = processes[i];
+        if (!rateMonotonic)
+            return deadline < 0 ? INT_MAX : deadline;
+        if (p.period > 0)
+            return p.period;
+        return p.deadline < 0 ? INT_MAX : p.deadline - p.arrivalTime;
+    };
+
+    typedef std::pair<int, int> Release;
+    std::priority_queue<Release, std::vector<Release>, std::greater<Release>> releases;
+    std::priority_queue<DeadlineJob, std::vector<DeadlineJob>, DeadlineJobOrder> ready;
+
+    for (int i = 0; i < n; ++i) {
+        if (processes[i].period <= 0 || processes[i].arrivalTime < horizon)
+            releases.push({ processes[i].arrivalTime, i });
+    }
+
+    std::vector<int> jobs(n, 0);
+    std::vector<int> missed(n, 0);
+    std::vector<int> maxLate(n, INT_MIN);
+
+    int currentTime = 0;
+    long long totalJobs = 0;
+    long long deadlineJobs = 0;
+    long long missedJobs = 0;
+    int maxLateness = INT_MIN;
+
+    double totalWaiting = 0.0;
+    double totalTurnaround = 0.0;
+
+    while (!ready.empty() || !releases.empty()) {
+        if (ready.empty() && releases.top().first > currentTime)
+            currentTime = releases.top().first;
+
+        while (!releases.empty() && releases.top().first <= currentTime) {
+            int release = releases.top().first;
+            int i = releases.top().second;
+            releases.pop();
+
+            const Process& p = processes[i];
+            int deadline = -1;
+            if (p.deadline >= 0)
+                deadline = p.deadline + (release - p.arrivalTime);
+            else if (p.period > 0)
+                deadline = release + p.period;
+            ready.push({ keyOf(i, deadline), deadline, release, p.burstTime, i });
+
+            if (p.period > 0 && release + p.period < horizon)
+                releases.push({ release + p.period, i });
         }
 
-        if (choice == 0) {
-            break;
+        DeadlineJob job = ready.top();
+        ready.pop();
+
+        Process& p = processes[job.task];
+        if (p.startTime == -1) {
+            p.startTime = currentTime;
         }
-        else if (choice == 1) {
-            simulateFCFS(processes);
+
+        int runTime = job.remaining;
+        if (!releases.empty())
+            runTime = std::min(runTime, releases.top().first - currentTime);
+        currentTime += runTime;
+        job.remaining -= runTime;
+
+        if (job.remaining > 0) {
+            ready.push(job);
+            continue;
         }
-        else if (choice == 2) {
-            int q;
-            std::cout << "Enter time quantum: ";
-            std::cin >> q;
-            simulateRoundRobin(processes, q);
+
+        int turnaround = currentTime - job.release;
+        p.finishTime = currentTime;
+        p.turnaroundTime += turnaround;
+        p.waitingTime += turnaround - p.burstTime;
+        jobs[job.task]++;
+
+        totalJobs++;
+        totalWaiting += turnaround - p.burstTime;
+        totalTurnaround += turnaround;
+
+        if (job.deadline >= 0) {
+            int lateness = currentTime - job.deadline;
+            deadlineJobs++;
+            maxLate[job.task] = std::max(maxLate[job.task], lateness);
+            maxLateness = std::max(maxLateness, lateness);
+            if (lateness > 0) {
+                missed[job.task]++;
+                missedJobs++;
+            }
         }
-        else if (choice == 3) {
-            simulatePriority(processes);
+    }
+
+    out << "\nResult table (" << name << "):\n";
+    out << std::left
+        << std::setw(5) << "ID"
+        << std::setw(10) << "Arrive"
+        << std::setw(10) << "Burst"
+        << std::setw(10) << "Period"
+        << std::setw(10) << "Deadline"
+        << std::setw(10) << "Start"
+        << std::setw(10) << "Finish"
+        << std::setw(8) << "Jobs"
+        << std::setw(8) << "Missed"
+        << std::setw(10) << "MaxLate"
+        << "\n";
+
+    for (int i = 0; i < n; ++i) {
+        const Process& p = processes[i];
+        out << std::left
+            << std::setw(5) << p.id
+            << std::setw(10) << p.arrivalTime
+            << std::setw(10) << p.burstTime
+            << std::setw(10) << p.period
+            << std::setw(10) << p.deadline
+            << std::setw(10) << p.startTime
+            << std::setw(10) << p.finishTime
+            << std::setw(8) << jobs[i]
+            << std::setw(8) << missed[i];
+        if (maxLate[i] == INT_MIN)
+            out << std::setw(10) << "-";
+        else
+            out << std::setw(10) << maxLate[i];
+        out << "\n";
+    }
+
+    out << "-----------------------------------------------\n";
+    double avgW = totalJobs > 0 ? totalWaiting / totalJobs : 0.0;
+    double avgT = totalJobs > 0 ? totalTurnaround / totalJobs : 0.0;
+    out << "Average waiting time:    " << avgW << "\n";
+    out << "Average turnaround time: " << avgT << "\n";
+
+    out << "Deadline miss ratio:     " << missedJobs << " / " << deadlineJobs;
+    if (deadlineJobs > 0)
+        out << " (" << 100.0 * missedJobs / deadlineJobs << "%)";
+    out << "\n";
+
+    out << "Maximum lateness:        ";
+    if (maxLateness == INT_MIN)
+        out << "-\n";
+    else
+        out << maxLateness << "\n";
+
+    int periodicCount = 0;
+    double utilization = 0.0;
+    double density = 0.0;
+    bool constrainedDeadlines = false;
+    std::vector<std::pair<int, int>> periodDeadlines;
+    for (const auto& p : processes) {
+        if (p.period > 0) {
+            int relative = p.deadline >= 0 ? p.deadline - p.arrivalTime : p.period;
+            periodicCount++;
+            utilization += static_cast<double>(p.burstTime) / p.period;
+            density += relative > 0
+                ? static_cast<double>(p.burstTime) / std::min(relative, p.period)
+                : HUGE_VAL;
+            if (relative < p.period)
+                constrainedDeadlines = true;
+            periodDeadlines.push_back({ p.period, relative });
         }
-        else if (choice == 4) {
-            simulateDynamicPriority(processes);
+    }
+
+    if (periodicCount == 0) {
+        out << "Utilization bound check: no periodic tasks\n\n";
+    }
+    else {
+        double bound = rateMonotonic
+            ? periodicCount * (std::pow(2.0, 1.0 / periodicCount) - 1.0)
+            : 1.0;
+        out << "Utilization:             " << utilization
+            << " (bound " << bound << ") -> ";
+        if (utilization > 1.0) {
+            out << "not schedulable\n\n";
         }
-        else if (choice == 5) {
-            simulateSJF(processes);
+        else if (!constrainedDeadlines) {
+            if (utilization <= bound)
+                out << "schedulable\n\n";
+            else
+                out << "not guaranteed by the bound\n\n";
         }
-        else if (choice == 6) {
-            runAllAlgorithms(processes);
+        else {
+            bool deadlineMonotonic = true;
+            if (rateMonotonic) {
+                std::sort(periodDeadlines.begin(), periodDeadlines.end());
+                for (std::size_t k = 1; k < periodDeadlines.size(); ++k) {
+                    const auto& a = periodDeadlines[k - 1];
+                    const auto& b = periodDeadlines[k];
+                    if (a.second > b.second || (a.first == b.first && a.second != b.second))
+                        deadlineMonotonic = false;
+                }
+            }
+
+            out << "deadlines shorter than periods, see density\n";
+            out << "Density:                 " << density
+                << " (bound " << bound << ") -> ";
+            if (density <= bound && deadlineMonotonic)
+                out << "schedulable\n\n";
+            else
+                out << "sufficient test failed (inconclusive)\n\n";
+        }
+    }
+
+    return { avgW, avgT, name };
+}
+
+ResultSummary simulateEDF(std::vector<Process> processes, int horizon, std::ostream& out = std::cout) {
+    return simulateDeadlineScheduler(std::move(processes), horizon, false, out);
+}
+
+ResultSummary simulateRateMonotonic(std::vector<Process> processes, int horizon, std::ostream& out = std::cout) {
+    return simulateDeadlineScheduler(std::move(processes), horizon, true, out);
+}
+
+std::vector<ResultSummary> runAllAlgorithms(const std::vector<Process>& base, std::ostream& out = std::cout) {
+    out << "\n=== RUNNING ALL ALGORITHMS ON SAME PROCESS SET ===\n";
+
+    std::vector<ResultSummary> results;
+
+    results.push_back(simulateHeapScheduler(base, HeapPolicy::FCFS, out));
+
+    int quantum = 2;
+    out << "\n[INFO] Using quantum = " << quantum << " for Round Robin in summary mode.\n";
+    results.push_back(simulateRoundRobin(base, quantum, out));
+    results.push_back(simulateHeapScheduler(base, HeapPolicy::Priority, out));
+    results.push_back(simulateDynamicPriority(base, out));
+    results.push_back(simulateHeapScheduler(base, HeapPolicy::SJF, out));
+    results.push_back(simulateEDF(base, periodicHorizon(base), out));
+    results.push_back(simulateRateMonotonic(base, periodicHorizon(base), out));
+
+    out << "\n=== SUMMARY TABLE (AVERAGE TIMES) ===\n";
+    out << std::left
+        << std::setw(20) << "Algorithm"
+        << std::setw(20) << "Avg Waiting"
+        << std::setw(20) << "Avg Turnaround"
+        << "\n";
+
+    for (const auto& r : results) {
+        out << std::left
+            << std::setw(20) << r.name
+            << std::setw(20) << r.avgWaiting
+            << std::setw(20) << r.avgTurnaround
+            << "\n";
+    }
+
+    out << "---------------------------------------------\n";
+
+    return results;
+}
+
+enum class CheckpointAlgorithm : unsigned char {
+    RoundRobin = 1,
+    DynamicPriority = 2
+};
+
+struct SimulationState {
+    CheckpointAlgorithm algorithm = CheckpointAlgorithm::RoundRobin;
+    int quantum = 0;
+    int currentTime = 0;
+    int completed = 0;
+    long long events = 0;
+    double totalWaiting = 0.0;
+    double totalTurnaround = 0.0;
+    std::vector<Process> processes;
+    std::deque<int> readyQueue;
+    std::vector<bool> inQueue;
+    std::vector<bool> finished;
+};
+
+const char checkpointMagic[] = "L3SNAP";
+const unsigned char checkpointVersion = 1;
+
+void writeVarint(std::string& buffer, unsigned long long value) {
+    while (value >= 0x80) {
+        buffer.push_back(static_cast<char>((value & 0x7F) | 0x80));
+        value >>= 7;
+    }
+    buffer.push_back(static_cast<char>(value));
+}
+
+void writeSigned(std::string& buffer, long long value) {
+    writeVarint(buffer, (static_cast<unsigned long long>(value) << 1) ^ static_cast<unsigned long long>(value >> 63));
+}
+
+void writeDouble(std::string& buffer, double value) {
+    unsigned long long bits;
+    std::memcpy(&bits, &value, sizeof(bits));
+    for (int i = 0; i < 8; ++i)
+        buffer.push_back(static_cast<char>((bits >> (8 * i)) & 0xFF));
+}
+
+bool readVarint(const std::string& buffer, std::size_t& pos, unsigned long long& value) {
+    value = 0;
+    for (int shift = 0; shift < 64; shift += 7) {
+        if (pos >= buffer.size())
+            return false;
+        unsigned char byte = static_cast<unsigned char>(buffer[pos++]);
+        value |= static_cast<unsigned long long>(byte & 0x7F) << shift;
+        if (!(byte & 0x80))
+            return true;
+    }
+    return false;
+}
+
+bool readSigned(const std::string& buffer, std::size_t& pos, long long& value) {
+    unsigned long long raw;
+    if (!readVarint(buffer, pos, raw))
+        return false;
+    value = static_cast<long long>(raw >> 1) ^ -static_cast<long long>(raw & 1);
+    return true;
+}
+
+bool readInt(const std::string& buffer, std::size_t& pos, int& value) {
+    long long wide;
+    if (!readSigned(buffer, pos, wide) || wide < INT_MIN || wide > INT_MAX)
+        return false;
+    value = static_cast<int>(wide);
+    return true;
+}
+
+bool readDouble(const std::string& buffer, std::size_t& pos, double& value) {
+    if (pos > buffer.size() || buffer.size() - pos < 8)
+        return false;
+    unsigned long long bits = 0;
+    for (int i = 0; i < 8; ++i)
+        bits |= static_cast<unsigned long long>(static_cast<unsigned char>(buffer[pos++])) << (8 * i);
+    std::memcpy(&value, &bits, sizeof(value));
+    return true;
+}
+
+std::string serializeState(const SimulationState& state) {
+    std::string buffer(checkpointMagic, sizeof(checkpointMagic) - 1);
+    buffer.push_back(static_cast<char>(checkpointVersion));
+    buffer.push_back(static_cast<char>(state.algorithm));
+    writeSigned(buffer, state.quantum);
+    writeSigned(buffer, state.currentTime);
+    writeSigned(buffer, state.completed);
+    writeSigned(buffer, state.events);
+    writeDouble(buffer, state.totalWaiting);
+    writeDouble(buffer, state.totalTurnaround);
+
+    writeVarint(buffer, state.processes.size());
+    for (std::size_t i = 0; i < state.processes.size(); ++i) {
+        const Process& p = state.processes[i];
+        const int fields[] = {
+            p.id, p.arrivalTime, p.burstTime, p.priority, p.initialPriority, p.remainingTime,
+            p.startTime, p.finishTime, p.waitingTime, p.turnaroundTime, p.deadline, p.period
+        };
+        for (int value : fields)
+            writeSigned(buffer, value);
+        buffer.push_back(static_cast<char>((state.finished[i] ? 1 : 0) | (state.inQueue[i] ? 2 : 0)));
+    }
+
+    writeVarint(buffer, state.readyQueue.size());
+    for (int idx : state.readyQueue)
+        writeVarint(buffer, static_cast<unsigned long long>(idx));
+
+    return buffer;
+}
+
+bool isConsistentState(const SimulationState& state) {
+    int n = static_cast<int>(state.processes.size());
+    if (n == 0 || state.events < 0)
+        return false;
+    if (state.algorithm == CheckpointAlgorithm::RoundRobin && state.quantum <= 0)
+        return false;
+    if (state.algorithm == CheckpointAlgorithm::DynamicPriority && !state.readyQueue.empty())
+        return false;
+
+    int finishedCount = 0;
+    int queuedCount = 0;
+    for (int i = 0; i < n; ++i) {
+        const Process& p = state.processes[i];
+        if (p.remainingTime < 0 || p.remainingTime > p.burstTime)
+            return false;
+        if (state.finished[i] != (p.remainingTime == 0))
+            return false;
+        if (state.finished[i])
+            finishedCount++;
+        if (state.inQueue[i])
+            queuedCount++;
+    }
+    if (state.completed != finishedCount)
+        return false;
+
+    std::vector<bool> seen(n, false);
+    for (int idx : state.readyQueue) {
+        if (!state.inQueue[idx] || state.finished[idx] || seen[idx])
+            return false;
+        seen[idx] = true;
+    }
+
+    return queuedCount == static_cast<int>(state.readyQueue.size());
+}
+
+bool deserializeState(const std::string& buffer, SimulationState& state) {
+    const std::size_t magicLength = sizeof(checkpointMagic) - 1;
+    if (buffer.size() < magicLength + 2 || buffer.compare(0, magicLength, checkpointMagic) != 0)
+        return false;
+    std::size_t pos = magicLength;
+    if (static_cast<unsigned char>(buffer[pos++]) != checkpointVersion)
+        return false;
+
+    unsigned char algorithm = static_cast<unsigned char>(buffer[pos++]);
+    if (algorithm != static_cast<unsigned char>(CheckpointAlgorithm::RoundRobin) &&
+        algorithm != static_cast<unsigned char>(CheckpointAlgorithm::DynamicPriority))
+        return false;
+    state.algorithm = static_cast<CheckpointAlgorithm>(algorithm);
+
+    unsigned long long count;
+    if (!readInt(buffer, pos, state.quantum) ||
+        !readInt(buffer, pos, state.currentTime) ||
+        !readInt(buffer, pos, state.completed) ||
+        !readSigned(buffer, pos, state.events) ||
+        !readDouble(buffer, pos, state.totalWaiting) ||
+        !readDouble(buffer, pos, state.totalTurnaround) ||
+        !readVarint(buffer, pos, count) ||
+        count > buffer.size())
+        return false;
+
+    int n = static_cast<int>(count);
+    state.processes.assign(n, Process());
+    state.finished.assign(n, false);
+    state.inQueue.assign(n, false);
+    for (int i = 0; i < n; ++i) {
+        Process& p = state.processes[i];
+        int* fields[] = {
+            &p.id, &p.arrivalTime, &p.burstTime, &p.priority, &p.initialPriority, &p.remainingTime,
+            &p.startTime, &p.finishTime, &p.waitingTime, &p.turnaroundTime, &p.deadline, &p.period
+        };
+        for (int* field : fields) {
+            if (!readInt(buffer, pos, *field))
+                return false;
+        }
+        if (pos >= buffer.size())
+            return false;
+        unsigned char flags = static_cast<unsigned char>(buffer[pos++]);
+        state.finished[i] = (flags & 1) != 0;
+        state.inQueue[i] = (flags & 2) != 0;
+    }
+
+    if (!readVarint(buffer, pos, count) || count > buffer.size())
+        return false;
+    state.readyQueue.clear();
+    for (unsigned long long k = 0; k < count; ++k) {
+        unsigned long long idx;
+        if (!readVarint(buffer, pos, idx) || idx >= static_cast<unsigned long long>(n))
+            return false;
+        state.readyQueue.push_back(static_cast<int>(idx));
+    }
+
+    return pos == buffer.size() && isConsistentState(state);
+}
+
+bool replaceFile(const std::string& from, const std::string& to) {
+#ifdef _WIN32
+    if (MoveFileExA(from.c_str(), to.c_str(), MOVEFILE_REPLACE_EXISTING | MOVEFILE_WRITE_THROUGH))
+        return true;
+#else
+    if (std::rename(from.c_str(), to.c_str()) == 0)
+        return true;
+#endif
+    std::remove(to.c_str());
+    return std::rename(from.c_str(), to.c_str()) == 0;
+}
+
+bool saveCheckpoint(const SimulationState& state, const std::string& path) {
+    const std::string tmpPath = path + ".tmp";
+    {
+        std::ofstream file(tmpPath, std::ios::binary | std::ios::trunc);
+        if (!file)
+            return false;
+        const std::string buffer = serializeState(state);
+        file.write(buffer.data(), static_cast<std::streamsize>(buffer.size()));
+        file.close();
+        if (!file) {
+            std::remove(tmpPath.c_str());
+            return false;
+        }
+    }
+    return replaceFile(tmpPath, path);
+}
+
+bool loadCheckpoint(const std::string& path, SimulationState& state) {
+    std::ifstream file(path, std::ios::binary);
+    if (!file) {
+        std::cout << "Cannot open checkpoint: " << path << "\n";
+        return false;
+    }
+    std::ostringstream content;
+    content << file.rdbuf();
+    if (!deserializeState(content.str(), state)) {
+        std::cout << "Corrupted or unsupported checkpoint: " << path << "\n";
+        return false;
+    }
+    return true;
+}
+
+SimulationState initRoundRobinState(std::vector<Process> processes, int quantum) {
+    SimulationState state;
+    state.algorithm = CheckpointAlgorithm::RoundRobin;
+    state.quantum = quantum;
+
+    int n = static_cast<int>(processes.size());
+    for (auto& p : processes) {
+        p.remainingTime = p.burstTime;
+        p.startTime = -1;
+        p.finishTime = -1;
+        p.waitingTime = 0;
+        p.turnaroundTime = 0;
+    }
+    state.processes = std::move(processes);
+    state.inQueue.assign(n, false);
+    state.finished.assign(n, false);
+
+    int firstIndex = 0;
+    int earliestArrival = state.processes[0].arrivalTime;
+    for (int i = 1; i < n; ++i) {
+        if (state.processes[i].arrivalTime < earliestArrival) {
+            earliestArrival = state.processes[i].arrivalTime;
+            firstIndex = i;
+        }
+    }
+    state.currentTime = earliestArrival;
+    state.readyQueue.push_back(firstIndex);
+    state.inQueue[firstIndex] = true;
+
+    return state;
+}
+
+SimulationState initDynamicPriorityState(std::vector<Process> processes) {
+    SimulationState state;
+    state.algorithm = CheckpointAlgorithm::DynamicPriority;
+
+    int n = static_cast<int>(processes.size());
+    for (auto& p : processes) {
+        p.remainingTime = p.burstTime;
+        p.startTime = -1;
+        p.finishTime = -1;
+        p.waitingTime = 0;
+        p.turnaroundTime = 0;
+        p.priority = p.initialPriority;
+    }
+    state.processes = std::move(processes);
+    state.inQueue.assign(n, false);
+    state.finished.assign(n, false);
+
+    int earliestArrival = INT_MAX;
+    for (int i = 0; i < n; ++i) {
+        if (state.processes[i].arrivalTime < earliestArrival)
+            earliestArrival = state.processes[i].arrivalTime;
+    }
+    state.currentTime = earliestArrival;
+
+    return state;
+}
+
+bool stepRoundRobin(SimulationState& state, std::ostream& out) {
+    int n = static_cast<int>(state.processes.size());
+    if (state.completed >= n)
+        return false;
+
+    std::vector<Process>& processes = state.processes;
+
+    if (state.readyQueue.empty()) {
+        int nextIndex = -1;
+        int nextArrival = INT_MAX;
+        for (int i = 0; i < n; ++i) {
+            if (!state.finished[i] && processes[i].arrivalTime < nextArrival) {
+                nextArrival = processes[i].arrivalTime;
+                nextIndex = i;
+            }
+        }
+        if (nextIndex == -1)
+            return false;
+        state.currentTime = nextArrival;
+        state.readyQueue.push_back(nextIndex);
+        state.inQueue[nextIndex] = true;
+    }
+
+    int idx = state.readyQueue.front();
+    state.readyQueue.pop_front();
+
+    Process& p = processes[idx];
+
+    if (p.startTime == -1) {
+        p.startTime = state.currentTime;
+    }
+
+    int runTime = std::min(state.quantum, p.remainingTime);
+    int startSlice = state.currentTime;
+    state.currentTime += runTime;
+    p.remainingTime -= runTime;
+
+    out << "t=" << startSlice << " .. " << state.currentTime
+        << " | P" << p.id
+        << " ran for " << runTime
+        << ", remaining = " << p.remainingTime << "\n";
+
+    for (int i = 0; i < n; ++i) {
+        if (!state.finished[i] && !state.inQueue[i] && processes[i].arrivalTime <= state.currentTime) {
+            state.readyQueue.push_back(i);
+            state.inQueue[i] = true;
+        }
+    }
+
+    if (p.remainingTime == 0) {
+        state.finished[idx] = true;
+        state.inQueue[idx] = false;
+        p.finishTime = state.currentTime;
+        p.turnaroundTime = p.finishTime - p.arrivalTime;
+        p.waitingTime = p.turnaroundTime - p.burstTime;
+
+        state.totalWaiting += p.waitingTime;
+        state.totalTurnaround += p.turnaroundTime;
+        state.completed++;
+    }
+    else {
+        state.readyQueue.push_back(idx);
+    }
+
+    state.events++;
+    return true;
+}
+
+bool stepDynamicPriority(SimulationState& state, std::ostream& out) {
+    int n = static_cast<int>(state.processes.size());
+    if (state.completed >= n)
+        return false;
+
+    std::vector<Process>& processes = state.processes;
+
+    int best = -1;
+    int bestPrio = INT_MAX;
+
+    for (int i = 0; i < n; ++i) {
+        if (!state.finished[i] &&
+            processes[i].arrivalTime <= state.currentTime &&
+            processes[i].remainingTime > 0) {
+
+            if (processes[i].priority < bestPrio) {
+                bestPrio = processes[i].priority;
+                best = i;
+            }
+        }
+    }
+
+    if (best == -1) {
+        int nextArrival = INT_MAX;
+        for (int i = 0; i < n; ++i) {
+            if (!state.finished[i] && processes[i].arrivalTime < nextArrival) {
+                nextArrival = processes[i].arrivalTime;
+            }
+        }
+        if (nextArrival == INT_MAX)
+            return false;
+        state.currentTime = nextArrival;
+        state.events++;
+        return true;
+    }
+
+    Process& p = processes[best];
+
+    if (p.startTime == -1) {
+        p.startTime = state.currentTime;
+    }
+
+    int startT = state.currentTime;
+    p.remainingTime--;
+    state.currentTime++;
+
+    out << "t=" << startT
+        << " | running P" << p.id
+        << " (prio=" << p.priority << "), remaining="
+        << p.remainingTime << "\n";
+
+    for (int i = 0; i < n; ++i) {
+        if (i == best) continue;
+        if (!state.finished[i] &&
+            processes[i].arrivalTime <= state.currentTime &&
+            processes[i].remainingTime > 0) {
+
+            if (processes[i].priority > 1)
+                processes[i].priority--;
+        }
+    }
+
+    if (p.remainingTime == 0) {
+        state.finished[best] = true;
+        p.finishTime = state.currentTime;
+        p.turnaroundTime = p.finishTime - p.arrivalTime;
+        p.waitingTime = p.turnaroundTime - p.burstTime;
+
+        state.totalWaiting += p.waitingTime;
+        state.totalTurnaround += p.turnaroundTime;
+        state.completed++;
+    }
+
+    state.events++;
+    return true;
+}
+
+struct CheckpointOptions {
+    std::string path;
+    long long every = 0;
+    int keep = 0;
+};
+
+ResultSummary runCheckpointed(SimulationState& state, const CheckpointOptions& checkpoint, std::ostream& out,
+    bool* checkpointFailed = nullptr) {
+    const bool roundRobin = state.algorithm == CheckpointAlgorithm::RoundRobin;
+    const std::string name = roundRobin ? "Round Robin" : "Dynamic Priority";
+
+    if (roundRobin) {
+        out << "\n=== Round Robin Scheduling ===\n";
+        out << "Time quantum = " << state.quantum << "\n";
+    }
+    else {
+        out << "\n=== Dynamic Priority Scheduling (Preemptive with Aging) ===\n";
+    }
+    if (state.events > 0)
+        out << "Resumed at t=" << state.currentTime << " after " << state.events << " events\n";
+
+    if (roundRobin)
+        out << "\nExecution log (time slices):\n";
+    else
+        out << "\nExecution log (time = 1 unit per step):\n";
+
+    bool checkpointing = checkpoint.every > 0 && !checkpoint.path.empty();
+    std::deque<std::string> kept;
+    while (roundRobin ? stepRoundRobin(state, out) : stepDynamicPriority(state, out)) {
+        if (!checkpointing || state.events % checkpoint.every != 0)
+            continue;
+
+        const std::string target = checkpoint.keep == 0
+            ? checkpoint.path
+            : checkpoint.path + "." + std::to_string(state.events);
+        if (!saveCheckpoint(state, target)) {
+            std::cout << "Checkpoint write failed: " << target
+                << " (t=" << state.currentTime << ", event " << state.events << "); checkpointing stopped\n";
+            checkpointing = false;
+            if (checkpointFailed)
+                *checkpointFailed = true;
+        }
+        else if (checkpoint.keep > 0) {
+            kept.push_back(target);
+            if (static_cast<int>(kept.size()) > checkpoint.keep) {
+                std::remove(kept.front().c_str());
+                kept.pop_front();
+            }
+        }
+    }
+
+    const std::vector<Process>& processes = state.processes;
+    int n = static_cast<int>(processes.size());
+
+    out << "\nResult table (" << name << "):\n";
+    out << std::left
+        << std::setw(5) << "ID"
+        << std::setw(10) << "Arrive"
+        << std::setw(10) << "Burst";
+    if (!roundRobin)
+        out << std::setw(12) << "InitPrio"
+        << std::setw(12) << "FinalPrio";
+    out << std::setw(10) << "Start"
+        << std::setw(10) << "Finish"
+        << std::setw(12) << "Waiting"
+        << std::setw(12) << "Turnaround"
+        << "\n";
+
+    for (const auto& p : processes) {
+        out << std::left
+            << std::setw(5) << p.id
+            << std::setw(10) << p.arrivalTime
+            << std::setw(10) << p.burstTime;
+        if (!roundRobin)
+            out << std::setw(12) << p.initialPriority
+            << std::setw(12) << p.priority;
+        out << std::setw(10) << p.startTime
+            << std::setw(10) << p.finishTime
+            << std::setw(12) << p.waitingTime
+            << std::setw(12) << p.turnaroundTime
+            << "\n";
+    }
+
+    out << "-----------------------------------------------\n";
+    double avgW = state.totalWaiting / n;
+    double avgT = state.totalTurnaround / n;
+    out << "Average waiting time:    " << avgW << "\n";
+    out << "Average turnaround time: " << avgT << "\n\n";
+
+    return { avgW, avgT, name };
+}
+
+ResultSummary simulateRoundRobinCheckpointed(std::vector<Process> processes, int quantum,
+    const CheckpointOptions& checkpoint, std::ostream& out = std::cout, bool* checkpointFailed = nullptr) {
+    if (processes.empty()) {
+        out << "\n=== Round Robin Scheduling ===\nNo processes.\n";
+        return { 0.0, 0.0, "Round Robin" };
+    }
+    if (quantum <= 0) {
+        out << "Invalid quantum.\n";
+        return { 0.0, 0.0, "Round Robin" };
+    }
+
+    SimulationState state = initRoundRobinState(std::move(processes), quantum);
+    return runCheckpointed(state, checkpoint, out, checkpointFailed);
+}
+
+ResultSummary simulateDynamicPriorityCheckpointed(std::vector<Process> processes,
+    const CheckpointOptions& checkpoint, std::ostream& out = std::cout, bool* checkpointFailed = nullptr) {
+    if (processes.empty()) {
+        out << "\n=== Dynamic Priority Scheduling ===\nNo processes.\n";
+        return { 0.0, 0.0, "Dynamic Priority" };
+    }
+
+    SimulationState state = initDynamicPriorityState(std::move(processes));
+    return runCheckpointed(state, checkpoint, out, checkpointFailed);
+}
+
+struct BatchJob {
+    int line;
+    std::string workload;
+    std::string algorithm;
+    std::string label;
+    int quantum;
+    CheckpointOptions checkpoint;
+};
+
+struct BatchSpec {
+    std::string outputPath;
+    bool fullOutput = false;
+    int threads = 0;
+    std::map<std::string, std::vector<Process>> workloads;
+    std::map<std::string, SimulationState> snapshots;
+    std::vector<BatchJob> jobs;
+};
+
+bool parseBatchSpec(const std::string& path, BatchSpec& spec) {
+    std::ifstream in(path);
+    if (!in) {
+        std::cout << "Cannot open job spec: " << path << "\n";
+        return false;
+    }
+
+    std::string line;
+    int lineNo = 0;
+
+    auto fail = [&](const std::string& message) {
+        std::cout << "Spec error at " << path << ":" << lineNo << ": " << message << "\n";
+        return false;
+    };
+
+    auto parseCheckpoint = [&](const std::vector<std::string>& tokens, std::size_t pos, BatchJob& job) {
+        if (pos == tokens.size())
+            return true;
+        int every;
+        int keep = 0;
+        bool valid = tokens[pos] == "checkpoint" &&
+            (tokens.size() == pos + 3 || (tokens.size() == pos + 5 && tokens[pos + 3] == "keep")) &&
+            parseInt(tokens[pos + 2], every) && every > 0;
+        if (valid && tokens.size() == pos + 5) {
+            if (tokens[pos + 4] == "all")
+                keep = -1;
+            else
+                valid = parseInt(tokens[pos + 4], keep) && keep > 0;
+        }
+        if (!valid)
+            return fail("expected: checkpoint <path> <every-events> [keep <count>|keep all] at the end of the line");
+        job.checkpoint.path = tokens[pos + 1];
+        job.checkpoint.every = every;
+        job.checkpoint.keep = keep;
+        return true;
+    };
+
+    while (std::getline(in, line)) {
+        lineNo++;
+        std::string::size_type hash = line.find('#');
+        if (hash != std::string::npos)
+            line.erase(hash);
+
+        std::istringstream fields(line);
+        std::vector<std::string> tokens;
+        std::string token;
+        while (fields >> token)
+            tokens.push_back(token);
+        if (tokens.empty())
+            continue;
+
+        const std::string& keyword = tokens[0];
+        const std::size_t size = tokens.size();
+
+        if (keyword == "output") {
+            if (size != 2)
+                return fail("expected: output <path>");
+            spec.outputPath = tokens[1];
+        }
+        else if (keyword == "level") {
+            if (size == 2 && tokens[1] == "full")
+                spec.fullOutput = true;
+            else if (size == 2 && tokens[1] == "summary")
+                spec.fullOutput = false;
+            else
+                return fail("expected: level summary|full");
+        }
+        else if (keyword == "threads") {
+            if (size != 2 || !parseInt(tokens[1], spec.threads) || spec.threads < 0)
+                return fail("expected: threads <count >= 0>");
+        }
+        else if (keyword == "workload") {
+            if (size < 3)
+                return fail("expected: workload <name> random|periodic|file ...");
+            const std::string& name = tokens[1];
+            const std::string& source = tokens[2];
+            if (spec.workloads.count(name))
+                return fail("workload '" + name + "' is already defined");
+
+            std::vector<Process> processes;
+            if (source == "random" || source == "periodic") {
+                const std::string usage = source == "random"
+                    ? "expected: workload <name> random <count> [seed]"
+                    : "expected: workload <name> periodic <count> [seed [utilization > 0]]";
+                const std::size_t maxSize = source == "random" ? 5 : 6;
+
+                int count;
+                int seed = 0;
+                double utilization = 0.7;
+                if (size < 4 || size > maxSize ||
+                    !parseInt(tokens[3], count) || count <= 0 ||
+                    (size > 4 && (!parseInt(tokens[4], seed) || seed < 0)) ||
+                    (size > 5 && (!parseDouble(tokens[5], utilization) || utilization <= 0.0)))
+                    return fail(usage);
+
+                std::mt19937 gen;
+                if (size > 4) {
+                    gen.seed(static_cast<unsigned>(seed));
+                }
+                else {
+                    std::random_device rd;
+                    gen.seed(rd());
+                }
+
+                if (source == "random")
+                    processes = generateProcesses(count, gen);
+                else
+                    processes = generatePeriodicTasks(count, gen, utilization);
+            }
+            else if (source == "file") {
+                if (size != 4)
+                    return fail("expected: workload <name> file <path>");
+                if (!loadProcessesFromFile(tokens[3], processes))
+                    return fail("cannot load workload '" + name + "'");
+            }
+            else {
+                return fail("unknown workload source '" + source + "'");
+            }
+
+            spec.workloads[name] = std::move(processes);
+        }
+        else if (keyword == "job") {
+            BatchJob job;
+            job.line = lineNo;
+            job.quantum = 0;
+            if (size < 3)
+                return fail("expected: job <workload> <algorithm> [quantum]");
+            job.workload = tokens[1];
+            job.algorithm = tokens[2];
+            if (!spec.workloads.count(job.workload))
+                return fail("unknown workload '" + job.workload + "'");
+
+            job.label = job.algorithm;
+            if (job.algorithm == "rr") {
+                if (size < 4 || !parseInt(tokens[3], job.quantum) || job.quantum <= 0)
+                    return fail("expected: job <workload> rr <quantum> [checkpoint <path> <every-events>]");
+                job.label += " q=" + std::to_string(job.quantum);
+                if (!parseCheckpoint(tokens, 4, job))
+                    return false;
+            }
+            else if (job.algorithm == "dynamic") {
+                if (!parseCheckpoint(tokens, 3, job))
+                    return false;
+            }
+            else if (job.algorithm != "fcfs" && job.algorithm != "priority" &&
+                job.algorithm != "sjf" &&
+                job.algorithm != "edf" && job.algorithm != "rm" &&
+                job.algorithm != "all") {
+                return fail("unknown algorithm '" + job.algorithm + "'");
+            }
+            else if (size != 3) {
+                return fail("'" + job.algorithm + "' takes no arguments; checkpoints are only supported for rr and dynamic");
+            }
+
+            spec.jobs.push_back(job);
+        }
+        else if (keyword == "resume") {
+            BatchJob job;
+            job.line = lineNo;
+            job.algorithm = "resume";
+            job.quantum = 0;
+            if (size < 2)
+                return fail("expected: resume <snapshot> [quantum] [checkpoint <path> <every-events> [keep ...]]");
+            job.workload = tokens[1];
+
+            if (!spec.snapshots.count(job.workload)) {
+                SimulationState state;
+                if (!loadCheckpoint(job.workload, state))
+                    return fail("cannot load snapshot '" + job.workload + "'");
+                spec.snapshots[job.workload] = std::move(state);
+            }
+            const SimulationState& snapshot = spec.snapshots[job.workload];
+
+            job.label = "resume";
+            std::size_t pos = 2;
+            if (pos < size && tokens[pos] != "checkpoint") {
+                if (!parseInt(tokens[pos], job.quantum) || job.quantum <= 0 ||
+                    snapshot.algorithm != CheckpointAlgorithm::RoundRobin)
+                    return fail("quantum override needs a Round Robin snapshot and a positive quantum");
+                job.label += " q=" + std::to_string(job.quantum);
+                pos++;
+            }
+            if (!parseCheckpoint(tokens, pos, job))
+                return false;
+
+            spec.jobs.push_back(job);
+        }
+        else {
+            return fail("unknown keyword '" + keyword + "'");
+        }
+    }
+
+    std::set<std::string> checkpointPaths;
+    for (const auto& job : spec.jobs) {
+        if (job.checkpoint.path.empty())
+            continue;
+        lineNo = job.line;
+        if (!checkpointPaths.insert(job.checkpoint.path).second)
+            return fail("checkpoint '" + job.checkpoint.path + "' is already written by another job");
+    }
+    for (const auto& job : spec.jobs) {
+        if (job.algorithm != "resume")
+            continue;
+        for (const auto& target : checkpointPaths) {
+            if (job.workload == target || job.workload.compare(0, target.size() + 1, target + ".") == 0) {
+                lineNo = job.line;
+                return fail("snapshot '" + job.workload + "' is also a checkpoint target of this spec; "
+                    "resume it in a separate run");
+            }
+        }
+    }
+
+    return true;
+}
+
+std::vector<ResultSummary> runBatchJob(const BatchSpec& spec, const BatchJob& job, std::ostream& out,
+    bool& checkpointFailed) {
+    std::vector<ResultSummary> results;
+
+    if (job.algorithm == "resume") {
+        SimulationState state = spec.snapshots.at(job.workload);
+        if (job.quantum > 0)
+            state.quantum = job.quantum;
+        results.push_back(runCheckpointed(state, job.checkpoint, out, &checkpointFailed));
+        return results;
+    }
+
+    const std::vector<Process>& processes = spec.workloads.at(job.workload);
+
+    if (job.algorithm == "rr" && !job.checkpoint.path.empty())
+        results.push_back(simulateRoundRobinCheckpointed(processes, job.quantum, job.checkpoint, out, &checkpointFailed));
+    else if (job.algorithm == "dynamic" && !job.checkpoint.path.empty())
+        results.push_back(simulateDynamicPriorityCheckpointed(processes, job.checkpoint, out, &checkpointFailed));
+    else if (job.algorithm == "fcfs")
+        results.push_back(simulateHeapScheduler(processes, HeapPolicy::FCFS, out));
+    else if (job.algorithm == "rr")
+        results.push_back(simulateRoundRobin(processes, job.quantum, out));
+    else if (job.algorithm == "priority")
+        results.push_back(simulateHeapScheduler(processes, HeapPolicy::Priority, out));
+    else if (job.algorithm == "dynamic")
+        results.push_back(simulateDynamicPriority(processes, out));
+    else if (job.algorithm == "sjf")
+        results.push_back(simulateHeapScheduler(processes, HeapPolicy::SJF, out));
+    else if (job.algorithm == "edf")
+        results.push_back(simulateEDF(processes, periodicHorizon(processes), out));
+    else if (job.algorithm == "rm")
+        results.push_back(simulateRateMonotonic(processes, periodicHorizon(processes), out));
+    else if (job.algorithm == "all")
+        results = runAllAlgorithms(processes, out);
+
+    return results;
+}
+
+int runBatch(const std::string& specPath) {
+    BatchSpec spec;
+    if (!parseBatchSpec(specPath, spec))
+        return 1;
+
+    std::ofstream file;
+    if (!spec.outputPath.empty()) {
+        file.open(spec.outputPath);
+        if (!file) {
+            std::cout << "Cannot open output file: " << spec.outputPath << "\n";
+            return 1;
+        }
+    }
+    std::ostream& out = spec.outputPath.empty() ? std::cout : file;
+
+    int jobCount = static_cast<int>(spec.jobs.size());
+    int threadCount = spec.threads > 0
+        ? spec.threads
+        : static_cast<int>(std::thread::hardware_concurrency());
+    threadCount = std::max(1, std::min(threadCount, jobCount));
+
+    const std::string partBase = spec.outputPath.empty() ? specPath : spec.outputPath;
+    std::vector<std::string> reports(jobCount);
+    std::vector<std::string> parts(jobCount);
+    std::vector<bool> ready(jobCount, false);
+    std::mutex mutex;
+    std::condition_variable jobDone;
+    std::atomic<int> nextJob(0);
+    std::atomic<bool> checkpointFailed(false);
+    std::atomic<bool> outputFailed(false);
+
+    auto worker = [&]() {
+        while (true) {
+            int k = nextJob++;
+            if (k >= jobCount)
+                return;
+
+            const BatchJob& job = spec.jobs[k];
+            std::ostringstream report;
+            std::ostream sink(nullptr);
+            std::ofstream part;
+            std::string partPath;
+
+            if (spec.fullOutput) {
+                partPath = partBase + ".job" + std::to_string(k + 1) + ".part";
+                part.open(partPath, std::ios::trunc);
+                if (!part) {
+                    std::cout << "Cannot open temporary job output: " << partPath << "\n";
+                    outputFailed = true;
+                    partPath.clear();
+                }
+                else {
+                    part << "\n##### Job " << k + 1 << " (line " << job.line << "): "
+                        << job.workload << " / " << job.label << " #####\n";
+                }
+            }
+
+            bool jobCheckpointFailed = false;
+            std::vector<ResultSummary> results =
+                runBatchJob(spec, job, partPath.empty() ? sink : part, jobCheckpointFailed);
+            if (!partPath.empty()) {
+                part.close();
+                if (!part) {
+                    std::cout << "Cannot write temporary job output: " << partPath << "\n";
+                    outputFailed = true;
+                }
+            }
+            if (jobCheckpointFailed)
+                checkpointFailed = true;
+
+            for (const auto& r : results) {
+                report << std::left
+                    << std::setw(6) << k + 1
+                    << std::setw(16) << job.workload
+                    << std::setw(12) << job.label
+                    << std::setw(20) << r.name
+                    << std::setw(16) << r.avgWaiting
+                    << std::setw(16) << r.avgTurnaround
+                    << "\n";
+            }
+
+            {
+                std::lock_guard<std::mutex> lock(mutex);
+                reports[k] = report.str();
+                parts[k] = partPath;
+                ready[k] = true;
+            }
+            jobDone.notify_all();
+        }
+    };
+
+    out << std::left
+        << std::setw(6) << "Job"
+        << std::setw(16) << "Workload"
+        << std::setw(12) << "Spec"
+        << std::setw(20) << "Algorithm"
+        << std::setw(16) << "Avg Waiting"
+        << std::setw(16) << "Avg Turnaround"
+        << "\n";
+
+    std::vector<std::thread> pool;
+    for (int t = 0; t < threadCount; ++t)
+        pool.emplace_back(worker);
+
+    for (int k = 0; k < jobCount; ++k) {
+        std::string text;
+        std::string partPath;
+        {
+            std::unique_lock<std::mutex> lock(mutex);
+            jobDone.wait(lock, [&] { return ready[k]; });
+            text.swap(reports[k]);
+            partPath.swap(parts[k]);
+        }
+        if (!partPath.empty()) {
+            {
+                std::ifstream part(partPath);
+                if (part && part.peek() != std::ifstream::traits_type::eof())
+                    out << part.rdbuf();
+            }
+            std::remove(partPath.c_str());
+        }
+        out << text;
+        out.flush();
+    }
+
+    for (auto& t : pool)
+        t.join();
+
+    out << "---------------------------------------------\n";
+    out << "Batch finished: " << jobCount << " jobs, "
+        << spec.workloads.size() << " workloads, " << spec.snapshots.size() << " snapshots, "
+        << threadCount << " threads\n";
+
+    if (!spec.outputPath.empty())
+        std::cout << "Batch finished: " << jobCount << " jobs -> " << spec.outputPath << "\n";
+
+    if (checkpointFailed)
+        std::cout << "Some checkpoints could not be written.\n";
+    if (outputFailed)
+        std::cout << "Some job output could not be written.\n";
+    return checkpointFailed || outputFailed ? 1 : 0;
+}
+
+struct FuzzCase {
+    std::vector<Process> processes;
+    int quantum = 1;
+    long long splitEvent = 0;
+};
+
+struct FuzzTarget {
+    std::string name;
+    std::function<std::vector<Process>(const FuzzCase&)> reference;
+    std::function<std::vector<Process>(const FuzzCase&)> candidate;
+};
+
+std::vector<Process> resumeFromSplit(const FuzzCase& c, bool roundRobin) {
+    std::ostream sink(nullptr);
+    SimulationState state = roundRobin
+        ? initRoundRobinState(c.processes, c.quantum)
+        : initDynamicPriorityState(c.processes);
+
+    for (long long k = 0; k < c.splitEvent; ++k) {
+        if (!(roundRobin ? stepRoundRobin(state, sink) : stepDynamicPriority(state, sink)))
+            break;
+    }
+
+    SimulationState resumed;
+    if (!deserializeState(serializeState(state), resumed))
+        return {};
+    runCheckpointed(resumed, CheckpointOptions(), sink);
+    return resumed.processes;
+}
+
+std::vector<FuzzTarget> fuzzTargets() {
+    auto reference = [](ResultSummary(*simulate)(std::vector<Process>, std::ostream&, std::vector<Process>*)) {
+        return [simulate](const FuzzCase& c) {
+            std::ostream sink(nullptr);
+            std::vector<Process> result;
+            simulate(c.processes, sink, &result);
+            return result;
+        };
+    };
+    auto referenceRR = [](const FuzzCase& c) {
+        std::ostream sink(nullptr);
+        std::vector<Process> result;
+        simulateRoundRobin(c.processes, c.quantum, sink, &result);
+        return result;
+    };
+    auto heap = [](HeapPolicy policy) {
+        return [policy](const FuzzCase& c) {
+            std::ostream sink(nullptr);
+            std::vector<Process> result;
+            simulateHeapScheduler(c.processes, policy, sink, &result);
+            return result;
+        };
+    };
+
+    std::vector<FuzzTarget> targets;
+    targets.push_back({ "FCFS / heap", reference(simulateFCFS), heap(HeapPolicy::FCFS) });
+    targets.push_back({ "Priority / heap", reference(simulatePriority), heap(HeapPolicy::Priority) });
+    targets.push_back({ "SJF / heap", reference(simulateSJF), heap(HeapPolicy::SJF) });
+    targets.push_back({ "RR / checkpoint engine", referenceRR, [](const FuzzCase& c) {
+        std::ostream sink(nullptr);
+        SimulationState state = initRoundRobinState(c.processes, c.quantum);
+        runCheckpointed(state, CheckpointOptions(), sink);
+        return state.processes;
+    } });
+    targets.push_back({ "RR / resumed snapshot", referenceRR,
+        [](const FuzzCase& c) { return resumeFromSplit(c, true); } });
+    targets.push_back({ "Dynamic / checkpoint engine", reference(simulateDynamicPriority), [](const FuzzCase& c) {
+        std::ostream sink(nullptr);
+        SimulationState state = initDynamicPriorityState(c.processes);
+        runCheckpointed(state, CheckpointOptions(), sink);
+        return state.processes;
+    } });
+    targets.push_back({ "Dynamic / resumed snapshot", reference(simulateDynamicPriority),
+        [](const FuzzCase& c) { return resumeFromSplit(c, false); } });
+
+    return targets;
+}
+
+FuzzCase generateFuzzCase(std::mt19937& gen) {
+    std::uniform_int_distribution<int> shapeDist(0, 4);
+    std::uniform_int_distribution<int> countDist(1, 12);
+    std::uniform_int_distribution<int> coin(0, 1);
+
+    FuzzCase c;
+    c.quantum = std::uniform_int_distribution<int>(1, 6)(gen);
+    c.splitEvent = std::uniform_int_distribution<int>(0, 40)(gen);
+
+    int shape = shapeDist(gen);
+    int n = countDist(gen);
+    int sharedArrival = std::uniform_int_distribution<int>(0, 5)(gen);
+    int sharedBurst = std::uniform_int_distribution<int>(1, 4)(gen);
+    int sharedPrio = std::uniform_int_distribution<int>(1, 3)(gen);
+    int arrival = 0;
+
+    for (int i = 0; i < n; ++i) {
+        Process p;
+        p.id = i + 1;
+        p.arrivalTime = std::uniform_int_distribution<int>(0, 20)(gen);
+        p.burstTime = std::uniform_int_distribution<int>(1, 10)(gen);
+        p.priority = std::uniform_int_distribution<int>(1, 5)(gen);
+
+        if (shape == 1) {
+            p.arrivalTime = sharedArrival;
+        }
+        else if (shape == 2) {
+            arrival += std::uniform_int_distribution<int>(0, 30)(gen);
+            p.arrivalTime = arrival;
+            p.burstTime = std::uniform_int_distribution<int>(1, 3)(gen);
+        }
+        else if (shape == 3) {
+            p.arrivalTime = std::uniform_int_distribution<int>(0, 2)(gen) * 3;
+            p.burstTime = sharedBurst;
+            p.priority = sharedPrio;
+        }
+        else if (shape == 4) {
+            p.burstTime = std::uniform_int_distribution<int>(1, 2)(gen);
+            p.priority = std::uniform_int_distribution<int>(1, 2)(gen);
+        }
+
+        p.initialPriority = p.priority;
+        p.remainingTime = p.burstTime;
+        p.startTime = -1;
+        p.finishTime = -1;
+        p.waitingTime = 0;
+        p.turnaroundTime = 0;
+        p.deadline = -1;
+        p.period = 0;
+        c.processes.push_back(p);
+    }
+
+    if (coin(gen)) {
+        std::vector<int> ids(n);
+        for (int i = 0; i < n; ++i)
+            ids[i] = i + 1;
+        std::shuffle(ids.begin(), ids.end(), gen);
+        for (int i = 0; i < n; ++i)
+            c.processes[i].id = ids[i];
+    }
+
+    return c;
+}
+
+bool sameResults(const std::vector<Process>& expected, const std::vector<Process>& actual, std::string& difference) {
+    if (expected.size() != actual.size()) {
+        difference = "process count " + std::to_string(actual.size()) +
+            " != " + std::to_string(expected.size());
+        return false;
+    }
+
+    std::map<int, const Process*> byId;
+    for (const auto& p : expected)
+        byId[p.id] = &p;
+
+    for (const auto& p : actual) {
+        auto it = byId.find(p.id);
+        if (it == byId.end()) {
+            difference = "unexpected P" + std::to_string(p.id);
+            return false;
+        }
+        const Process& e = *it->second;
+        if (p.startTime != e.startTime || p.finishTime != e.finishTime || p.waitingTime != e.waitingTime) {
+            std::ostringstream message;
+            message << "P" << p.id
+                << " start/finish/wait = " << p.startTime << "/" << p.finishTime << "/" << p.waitingTime
+                << ", expected " << e.startTime << "/" << e.finishTime << "/" << e.waitingTime;
+            difference = message.str();
+            return false;
+        }
+    }
+
+    return true;
+}
+
+FuzzCase shrinkFuzzCase(FuzzCase c, const std::function<bool(const FuzzCase&)>& fails) {
+    bool changed = true;
+    while (changed) {
+        changed = false;
+
+        for (std::size_t i = 0; c.processes.size() > 1 && i < c.processes.size(); ) {
+            FuzzCase smaller = c;
+            smaller.processes.erase(smaller.processes.begin() + i);
+            if (fails(smaller)) {
+                c = smaller;
+                changed = true;
+            }
+            else {
+                ++i;
+            }
+        }
+
+        for (std::size_t i = 0; i < c.processes.size(); ++i) {
+            int Process::* fields[] = { &Process::arrivalTime, &Process::burstTime, &Process::initialPriority };
+            for (auto field : fields) {
+                const int floor = field == &Process::arrivalTime ? 0 : 1;
+                for (int candidate : { floor, c.processes[i].*field - 1 }) {
+                    if (candidate < floor || candidate >= c.processes[i].*field)
+                        continue;
+                    FuzzCase smaller = c;
+                    smaller.processes[i].*field = candidate;
+                    smaller.processes[i].priority = smaller.processes[i].initialPriority;
+                    smaller.processes[i].remainingTime = smaller.processes[i].burstTime;
+                    if (fails(smaller)) {
+                        c = smaller;
+                        changed = true;
+                        break;
+                    }
+                }
+            }
+        }
+
+        for (int candidate : { 1, c.quantum - 1 }) {
+            if (candidate < 1 || candidate >= c.quantum)
+                continue;
+            FuzzCase smaller = c;
+            smaller.quantum = candidate;
+            if (fails(smaller)) {
+                c = smaller;
+                changed = true;
+                break;
+            }
+        }
+
+        for (long long candidate : { 0LL, c.splitEvent / 2, c.splitEvent - 1 }) {
+            if (candidate < 0 || candidate >= c.splitEvent)
+                continue;
+            FuzzCase smaller = c;
+            smaller.splitEvent = candidate;
+            if (fails(smaller)) {
+                c = smaller;
+                changed = true;
+                break;
+            }
+        }
+    }
+
+    return c;
+}
+
+int runFuzz(int iterations, unsigned seed) {
+    if (iterations <= 0) {
+        std::cout << "Fuzzing needs at least one case per engine.\n";
+        return 1;
+    }
+
+    std::cout << "Differential fuzzing: " << iterations << " cases per engine, seed = " << seed << "\n";
+
+    std::vector<FuzzTarget> targets = fuzzTargets();
+    int failedTargets = 0;
+
+    for (const auto& target : targets) {
+        std::mt19937 gen(seed);
+        std::string difference;
+
+        auto fails = [&](const FuzzCase& c) {
+            return !sameResults(target.reference(c), target.candidate(c), difference);
+        };
+
+        int passed = 0;
+        for (; passed < iterations; ++passed) {
+            FuzzCase c = generateFuzzCase(gen);
+            if (!fails(c))
+                continue;
+
+            FuzzCase minimal = shrinkFuzzCase(c, fails);
+            fails(minimal);
+            failedTargets++;
+
+            std::cout << std::left << std::setw(30) << target.name
+                << "MISMATCH after " << passed << " cases: " << difference << "\n";
+            std::cout << "Minimal reproducer (quantum = " << minimal.quantum
+                << ", split event = " << minimal.splitEvent << "):\n";
+            std::cout << "# id arrival burst priority deadline period\n";
+            for (const auto& p : minimal.processes) {
+                std::cout << p.id << " " << p.arrivalTime << " " << p.burstTime << " "
+                    << p.initialPriority << " " << p.deadline << " " << p.period << "\n";
+            }
+            break;
+        }
+
+        if (passed == iterations)
+            std::cout << std::left << std::setw(30) << target.name << "OK (" << passed << " cases)\n";
+    }
+
+    std::cout << "---------------------------------------------\n";
+    std::cout << (failedTargets == 0 ? "All engines match the reference simulators.\n"
+        : "Some engines diverge from the reference simulators.\n");
+
+    return failedTargets == 0 ? 0 : 1;
+}
+
+int resumeSimulation(const std::string& snapshotPath, int quantum) {
+    SimulationState state;
+    if (!loadCheckpoint(snapshotPath, state))
+        return 1;
+
+    if (quantum > 0) {
+        if (state.algorithm != CheckpointAlgorithm::RoundRobin) {
+            std::cout << "Quantum override is only valid for Round Robin snapshots.\n";
+            return 1;
+        }
+        state.quantum = quantum;
+    }
+
+    runCheckpointed(state, CheckpointOptions(), std::cout);
+    return 0;
+}
+
+int main(int argc, char* argv[]) {
+    if (argc > 1 && std::string(argv[1]) == "--fuzz") {
+        int iterations = 1000;
+        int seed = static_cast<int>(std::random_device()() & INT_MAX);
+        if (argc > 4 ||
+            (argc > 2 && (!parseInt(argv[2], iterations) || iterations <= 0)) ||
+            (argc > 3 && (!parseInt(argv[3], seed) || seed < 0))) {
+            std::cout << "Usage: Lab_3 --fuzz [iterations > 0] [seed >= 0]\n";
+            return 1;
+        }
+        return runFuzz(iterations, static_cast<unsigned>(seed));
+    }
+    if (argc > 1 && std::string(argv[1]) == "--resume") {
+        int quantum = 0;
+        if (argc < 3 || argc > 4 || (argc == 4 && (!parseInt(argv[3], quantum) || quantum <= 0))) {
+            std::cout << "Usage: Lab_3 --resume <snapshot> [quantum > 0]\n";
+            return 1;
+        }
+        return resumeSimulation(argv[2], quantum);
+    }
+    if (argc > 1) {
+        return runBatch(argv[1]);
+    }
+
+    int n;
+    std::cout << "Enter number of processes: ";
+    std::cin >> n;
+
+    if (n <= 0) {
+        std::cout << "Invalid number.\n";
+        return 0;
+    }
+
+    auto processes = generateProcesses(n);
+    printProcesses(processes);
+
+    while (true) {
+        std::cout << "\nChoose algorithm:\n";
+        std::cout << "1 - FCFS (First-Come-First-Served)\n";
+        std::cout << "2 - Round Robin\n";
+        std::cout << "3 - Priority Scheduling (non-preemptive)\n";
+        std::cout << "4 - Dynamic Priority (preemptive, with aging)\n";
+        std::cout << "5 - Shortest Job First (SJF)\n";
+        std::cout << "6 - Run ALL algorithms and show summary\n";
+        std::cout << "7 - Earliest Deadline First (EDF, preemptive)\n";
+        std::cout << "8 - Rate Monotonic (preemptive, periodic tasks)\n";
+        std::cout << "9 - Replace process set with periodic tasks\n";
+        std::cout << "0 - Exit\n";
+        std::cout << "Your choice: ";
+
+        int choice;
+        std::cin >> choice;
+
+        if (!std::cin) {
+            std::cout << "Input error. Exiting.\n";
+            break;
+        }
+
+        if (choice == 0) {
+            break;
+        }
+        else if (choice == 1) {
+            simulateHeapScheduler(processes, HeapPolicy::FCFS);
+        }
+        else if (choice == 2) {
+            int q;
+            std::cout << "Enter time quantum: ";
+            std::cin >> q;
+            simulateRoundRobin(processes, q);
+        }
+        else if (choice == 3) {
+            simulateHeapScheduler(processes, HeapPolicy::Priority);
+        }
+        else if (choice == 4) {
+            simulateDynamicPriority(processes);
+        }
+        else if (choice == 5) {
+            simulateHeapScheduler(processes, HeapPolicy::SJF);
+        }
+        else if (choice == 6) {
+            runAllAlgorithms(processes);
+        }
+        else if (choice == 7) {
+            simulateEDF(processes, periodicHorizon(processes));
+        }
+        else if (choice == 8) {
+            simulateRateMonotonic(processes, periodicHorizon(processes));
+        }
+        else if (choice == 9) {
+            processes = generatePeriodicTasks(n);
+            printProcesses(processes);
         }
         else {
             std::cout << "Invalid choice.\n";